@@ -0,0 +1,2 @@
+#define BEAK_VERSION " with uncommitted changes"
+#define BEAK_COMMIT "7c377c2dc7e197968b8065c47b0dfc4507c1b8a6 but with uncommitted changes"
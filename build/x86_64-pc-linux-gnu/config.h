@@ -0,0 +1,65 @@
+/* /root/repo/build/x86_64-pc-linux-gnu/config.h.  Generated from config.h.in by configure.  */
+/* autoconf/config.h.in.  Generated from configure.ac by autoheader.  */
+
+/* Stat structure has st_mtim */
+#define HAS_ST_MTIM 1
+
+/* Stat structure has st_mtime */
+#define HAS_ST_MTIME 1
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+
+/* Define to 1 if you have the <memory.h> header file. */
+#define HAVE_MEMORY_H 1
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+
+/* Define to the address where bug reports for this package should be sent. */
+#define PACKAGE_BUGREPORT "oehrstroem@gmail.com"
+
+/* Define to the full name of this package. */
+#define PACKAGE_NAME "BEAK"
+
+/* Define to the full name and version of this package. */
+#define PACKAGE_STRING "BEAK beak"
+
+/* Define to the one symbol short name of this package. */
+#define PACKAGE_TARNAME "beak"
+
+/* Define to the home page for this package. */
+#define PACKAGE_URL "http://nivelleringslikaren.eu/beak"
+
+/* Define to the version of this package. */
+#define PACKAGE_VERSION "beak"
+
+/* The size of `time_t', as computed by sizeof. */
+#define SIZEOF_TIME_T 8
+
+/* Define to 1 if the `S_IS*' macros in <sys/stat.h> do not work properly. */
+/* #undef STAT_MACROS_BROKEN */
+
+/* Define to 1 if you have the ANSI C header files. */
+#define STDC_HEADERS 1
+
+/* Define to 1 if you can safely include both <sys/time.h> and <time.h>. */
+#define TIME_WITH_SYS_TIME 1
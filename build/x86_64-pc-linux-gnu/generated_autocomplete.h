@@ -0,0 +1,116 @@
+"# Bash auto completion for beak\n"
+"\n"
+"_beakusermounts()\n"
+"{\n"
+"    local cur=${COMP_WORDS[COMP_CWORD]}\n"
+"    local uid=$(id -u)\n"
+"    local mounts=$(cat /proc/mounts | grep fuse.beak | grep user_id=${uid} | cut -f 2 -d ' ' | sort)\n"
+"    if [ \"$mounts\" != \"\" ]; then\n"
+"        COMPREPLY=($(compgen -W \"$mounts\" -- $cur))\n"
+"    fi\n"
+"    return 0\n"
+"}\n"
+"\n"
+"_beakrules()\n"
+"{\n"
+"  COMPREPLY=\"\"\n"
+"  local cur=${COMP_WORDS[COMP_CWORD]}\n"
+"  local rules=\"\"\n"
+"  if [ -f ~/.config/beak/beak.conf ]; then\n"
+"      rules=$(grep -o \\\\[.*\\\\] ~/.config/beak/beak.conf | tr -d '[' | tr ']' ':' | sort)\n"
+"      if [ \"$rules\" != \"\" ]; then\n"
+"          COMPREPLY=($(compgen -W \"$rules\" -- $cur))\n"
+"      fi\n"
+"  fi\n"
+"  return 0\n"
+"}\n"
+"\n"
+"_beakorigins()\n"
+"{\n"
+"  local cur=${COMP_WORDS[COMP_CWORD]}\n"
+"  local rules=\"\"\n"
+"  if [ -f ~/.config/beak/beak.conf ]; then\n"
+"      rules=$(grep -o \\\\[.*\\\\] ~/.config/beak/beak.conf | tr -d '[' | tr ']' ':' | sort)\n"
+"  fi\n"
+"  if [ \"$rules\" != \"\" ]; then\n"
+"      COMPREPLY=($(compgen -W \"$rules\" -- $cur))\n"
+"      if [ -z \"$COMPREPLY\" ]; then\n"
+"          # No match for configured source trees. Try directories instead.\n"
+"          _filedir -d\n"
+"      fi\n"
+"  else\n"
+"      # No rules found, use directories.\n"
+"      _filedir -d\n"
+"  fi\n"
+"  return 0\n"
+"}\n"
+"\n"
+"_beakstorages()\n"
+"{\n"
+"  local cur=${COMP_WORDS[COMP_CWORD]}\n"
+"  local prev=${COMP_WORDS[COMP_CWORD-1]}\n"
+"  if [ \"$prev\" = \":\" ]; then prev=${COMP_WORDS[COMP_CWORD-2]}; fi\n"
+"  local remotes=\"\";\n"
+"  if [ -f ~/.config/beak/beak.conf ]; then\n"
+"      remotes=$(cat ~/.config/beak/beak.conf | grep -e 'remote\\ *=' | sed 's/remote.*= \\?//g' | sort | uniq)\n"
+"  fi\n"
+"  if [ \"$remotes\" != \"\" ]; then\n"
+"      COMPREPLY=($(compgen -W \"$remotes\" -- $cur))\n"
+"      if [ -z \"$COMPREPLY\" ]; then\n"
+"          # No match for configured remotes trees. Try directories instead.\n"
+"          _filedir -d\n"
+"      fi\n"
+"  else\n"
+"      # No remotes found, use directories.\n"
+"      _filedir -d\n"
+"  fi\n"
+"  return 0\n"
+"}\n"
+"\n"
+"_beak()\n"
+"{\n"
+"    local cur prev prevprev prevprevprev\n"
+"    cur=${COMP_WORDS[COMP_CWORD]}\n"
+"    prev=${COMP_WORDS[COMP_CWORD-1]}\n"
+"    prevprev=${COMP_WORDS[COMP_CWORD-2]}\n"
+"    prevprevprev=${COMP_WORDS[COMP_CWORD-3]}\n"
+"\n"
+"    # The colon in configured rules gets its own CWORD....\n"
+"    if [ \"$prev\" = \":\" ]; then prev=\"$prevprev\" ; prevprev=\"$prevprevprev\"; fi\n"
+"\n"
+"    case \"$prev\" in\n"
+"        bmount) _beakorigins ;;\n"
+"        diff) _beakorigins ;;\n"
+"        fsck) _beakstorages ;;\n"
+"        importmedia) _filedir -d ;;\n"
+"        indexmedia) _filedir -d ;;\n"
+"        mount) _beakstorages ;;\n"
+"        prune) _beakstorages ;;\n"
+"        pull) _beakrules ;;\n"
+"        push) _beakrules ;;\n"
+"        pushd) _beakrules ;;\n"
+"        restore) _beakstorages ;;\n"
+"        shell) _beakstorages ;;\n"
+"        status) _beakorigins ;;\n"
+"        store) _beakstorages ;;\n"
+"        stored) _beakstorages ;;\n"
+"        umount) _beakusermounts ;;\n"
+"    esac\n"
+"\n"
+"    case \"$prevprev\" in\n"
+"        bmount) _filedir -d ;;\n"
+"        diff) _beakstorages ;;\n"
+"        importmedia) _filedir -d ;;\n"
+"        indexmedia) _filedir -d ;;\n"
+"        mount) _filedir -d ;;\n"
+"        restore) _beakorigins ;;\n"
+"        store) _beakstorages ;;\n"
+"        stored) _beakstorages ;;\n"
+"    esac\n"
+"\n"
+"    if [ -z \"$COMPREPLY\" ]; then\n"
+"        COMPREPLY=($(compgen -W \"bmount config diff fsck genautocomplete genmounttrigger help prune importmedia indexmedia mount pull push pushd restore shell status store stored umount\" -- $cur))\n"
+"    fi\n"
+"}\n"
+"\n"
+"complete -F _beak beak\n"
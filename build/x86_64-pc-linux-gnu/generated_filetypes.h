@@ -0,0 +1,106 @@
+#define LIST_OF_SUFFIXES \
+X(7z,Archive)\
+X(apk,Archive)\
+X(arj,Archive)\
+X(deb,Archive)\
+X(gz,Archive)\
+X(tar.gz,Archive)\
+X(tgz,Archive)\
+X(pkg,Archive)\
+X(rar,Archive)\
+X(rpm,Archive)\
+X(xz,Archive)\
+X(z,Archive)\
+X(zip,Archive)\
+X(yml,Config)\
+X(cfg,Config)\
+X(conf,Config)\
+X(csv,Data)\
+X(dat,Data)\
+X(json,Data)\
+X(log,Data)\
+X(xml,Data)\
+X(iso,DiskImage)\
+X(dmg,DiskImage)\
+X(doc,Document)\
+X(docx,Document)\
+X(odt,Document)\
+X(ods,Document)\
+X(pdf,Document)\
+X(ps,Document)\
+X(rtf,Document)\
+X(key,Document)\
+X(pps,Document)\
+X(ppt,Document)\
+X(tex,Document)\
+X(txt,Document)\
+X(wks,Document)\
+X(wpd,Document)\
+X(wps,Document)\
+X(xls,Document)\
+X(xlsx,Document)\
+X(com,Executable)\
+X(exe,Executable)\
+X(jar,Executable)\
+X(ai,Image)\
+X(bmp,Image)\
+X(gif,Image)\
+X(ico,Image)\
+X(jpg,Image)\
+X(jpeg,Image)\
+X(png,Image)\
+X(psd,Image)\
+X(svg,Image)\
+X(tif,Image)\
+X(tiff,Image)\
+X(tga,Image)\
+X(xcf,Image)\
+X(c,Source)\
+X(h,Source)\
+X(m,Source)\
+X(cc,Source)\
+X(cs,Source)\
+X(js,Source)\
+X(pl,Source)\
+X(py,Source)\
+X(sh,Source)\
+X(vb,Source)\
+X(asm,Source)\
+X(bas,Source)\
+X(bat,Source)\
+X(cpp,Source)\
+X(dtd,Source)\
+X(hpp,Source)\
+X(sql,Source)\
+X(java,Source)\
+X(swift,Source)\
+X(makefile,Source)\
+X(vcxproj,Source)\
+X(xcodeproj,Source)\
+X(o,Object)\
+X(class,Object)\
+X(aif,Audio)\
+X(cda,Audio)\
+X(mid,Audio)\
+X(midi,Audio)\
+X(mp3,Audio)\
+X(mpa,Audio)\
+X(ogg,Audio)\
+X(wav,Audio)\
+X(wma,Audio)\
+X(flac,Audio)\
+X(avi,Video)\
+X(flv,Video)\
+X(h264,Video)\
+X(m4v,Video)\
+X(mkv,Video)\
+X(mov,Video)\
+X(mp4,Video)\
+X(mpg,Video)\
+X(mpeg,Video)\
+X(webm,Video)\
+X(wmv,Video)\
+X(css,Web)\
+X(htm,Web)\
+X(html,Web)\
+